@@ -0,0 +1,22 @@
+// Copyright 2025 Yuriy Agapov, All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class EasyGasMass : ModuleRules
+{
+	public EasyGasMass(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(new[]
+		{
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"GameplayAbilities",
+			"EasyGasCore",
+			"MassEntity",
+			"MassSpawner",
+		});
+	}
+}
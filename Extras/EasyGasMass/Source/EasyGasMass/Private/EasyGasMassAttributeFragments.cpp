@@ -0,0 +1,226 @@
+// Copyright 2025 Yuriy Agapov, All Rights Reserved.
+
+#include "EasyGasMassAttributeFragments.h"
+
+#include "EasyGasAttributeClampRule.h"
+#include "EasyGasAttributeSet.h"
+#include "EasyGasMassModule.h"
+#include "GameplayAttributeUtils.h"
+
+#include <Engine/DataTable.h>
+
+namespace
+{
+	const FAttributeMetaData* FindMetaData(const UDataTable* InMetaDataTable, const FGameplayAttribute& InAttribute)
+	{
+		if (!InMetaDataTable)
+			return nullptr;
+
+		// Same row naming as UAttributeSet::InitFromMetaDataTable
+		const FString RowName = FString::Printf(TEXT("%s.%s"), *InAttribute.GetAttributeSetClass()->GetName(), *InAttribute.GetName());
+		return InMetaDataTable->FindRow<FAttributeMetaData>(FName(RowName), TEXT("EasyGasMass"), false);
+	}
+
+	FEasyGasMassValueSource CompileValueSource(
+		const FEasyGasValueSource& InSource,
+		const FEasyGasMassAttributeLayout& InLayout,
+		const TOptional<float>& InTableValue)
+	{
+		FEasyGasMassValueSource Result;
+		switch (InSource.Type)
+		{
+		case EEasyGasValueSourceType::Constant:
+			Result.Value = InSource.Value;
+			break;
+		case EEasyGasValueSourceType::DataTable:
+			// Without a metadata row the cached value is used, as the native set does
+			Result.Value = InTableValue.Get(InSource.Value);
+			break;
+		case EEasyGasValueSourceType::Attribute:
+			Result.Slot = InLayout.FindSlot(InSource.Attribute);
+			Result.Value = InSource.Value;
+			if (Result.Slot == INDEX_NONE)
+			{
+				UE_LOG(LogEasyGasMass, Warning, TEXT("Value source attribute %s is not part of %s, cached value is used"),
+					*InSource.Attribute.GetName(), *GetNameSafe(InLayout.AttributeSetClass));
+			}
+			break;
+		}
+		return Result;
+	}
+}
+
+const UScriptStruct* EasyGasMass::GetFragmentType(const int32 InNumSlots)
+{
+	if (InNumSlots <= 8)
+		return FEasyGasMassAttributes8Fragment::StaticStruct();
+	if (InNumSlots <= 16)
+		return FEasyGasMassAttributes16Fragment::StaticStruct();
+	if (InNumSlots <= 32)
+		return FEasyGasMassAttributes32Fragment::StaticStruct();
+	if (InNumSlots <= MaxSlots)
+		return FEasyGasMassAttributes64Fragment::StaticStruct();
+	return nullptr;
+}
+
+void FEasyGasMassClampRule::Apply(const FEasyGasMassAttributeValues& Values) const
+{
+	const float Min = MinValue.GetValue(Values);
+	const float Max = MaxValue.GetValue(Values);
+	float Value = Values.GetValue(Slot);
+
+	if (RangeSlot != INDEX_NONE)
+	{
+		const float OldMin = Values.GetValue(RangeSlot);
+		const float OldMax = Values.GetValue(RangeSlot + 1);
+		if (OldMin != Min || OldMax != Max)
+		{
+			switch (Policy)
+			{
+			case FEasyGasAttributeClampPolicy::KeepRelative:
+			{
+				// An empty old range has no relative position, treat it as full
+				const float OldRange = OldMax - OldMin;
+				const float Alpha = FMath::IsNearlyZero(OldRange) ? 1.f : (Value - OldMin) / OldRange;
+				Value = FMath::Lerp(Min, Max, Alpha);
+				break;
+			}
+			case FEasyGasAttributeClampPolicy::UseMin:
+				Value = Min;
+				break;
+			case FEasyGasAttributeClampPolicy::UseMax:
+				Value = Max;
+				break;
+			case FEasyGasAttributeClampPolicy::KeepAbsolute:
+				break;
+			}
+			Values.SetValue(RangeSlot, Min);
+			Values.SetValue(RangeSlot + 1, Max);
+		}
+	}
+
+	Values.SetValue(Slot, FMath::Clamp(Value, Min, Max));
+}
+
+bool FEasyGasMassAttributeLayout::Build(
+	const TSubclassOf<UEasyGasAttributeSet>& InAttributeSetClass,
+	const UDataTable* InMetaDataTable,
+	FEasyGasMassAttributeLayout& OutLayout,
+	TArray<float>& OutDefaults)
+{
+	OutLayout = FEasyGasMassAttributeLayout();
+	OutDefaults.Reset();
+
+	const UEasyGasAttributeSet* AttributeSetCDO = InAttributeSetClass ? InAttributeSetClass->GetDefaultObject<UEasyGasAttributeSet>() : nullptr;
+	if (!AttributeSetCDO)
+	{
+		UE_LOG(LogEasyGasMass, Warning, TEXT("Failed to build Mass layout: AttributeSet class is not set"));
+		return false;
+	}
+	OutLayout.AttributeSetClass = InAttributeSetClass;
+
+	for (TFieldIterator<FProperty> It(InAttributeSetClass); It; ++It)
+	{
+		if (!GameplayAttributeUtils::IsAttributeType(*It))
+			continue;
+
+		if (OutLayout.Attributes.Num() == EasyGasMass::MaxSlots)
+		{
+			UE_LOG(LogEasyGasMass, Error, TEXT("Failed to build Mass layout: %s has more than %d attributes"),
+				*InAttributeSetClass->GetName(), EasyGasMass::MaxSlots);
+			return false;
+		}
+
+		const FGameplayAttribute Attribute(*It);
+		const FAttributeMetaData* MetaData = FindMetaData(InMetaDataTable, Attribute);
+		OutDefaults.Add(MetaData ? MetaData->BaseValue : Attribute.GetNumericValue(AttributeSetCDO));
+		OutLayout.Attributes.Add(Attribute);
+	}
+	OutLayout.NumSlots = OutLayout.Attributes.Num();
+
+	// Rules are private to UEasyGasAttributeSet, so they are read from the CDO through reflection
+	const FArrayProperty* RulesProperty = FindFProperty<FArrayProperty>(UEasyGasAttributeSet::StaticClass(), TEXT("Rules"));
+	if (!ensureMsgf(RulesProperty, TEXT("UEasyGasAttributeSet::Rules not found, EasyGasMass is not compatible with this EasyGasCore version")))
+		return false;
+	const TArray<UEasyGasAttributeRuleBase*>& Rules = *RulesProperty->ContainerPtrToValuePtr<TArray<UEasyGasAttributeRuleBase*>>(AttributeSetCDO);
+
+	for (const UEasyGasAttributeRuleBase* Rule : Rules)
+	{
+		const UEasyGasAttributeClampRule* ClampRule = Cast<UEasyGasAttributeClampRule>(Rule);
+		if (!ClampRule)
+		{
+			UE_LOG(LogEasyGasMass, Verbose, TEXT("Rule %s of %s is not supported by Mass and will be skipped"),
+				*GetNameSafe(Rule), *InAttributeSetClass->GetName());
+			continue;
+		}
+
+		FEasyGasMassClampRule CompiledRule;
+		CompiledRule.Slot = OutLayout.FindSlot(ClampRule->Attribute);
+		if (CompiledRule.Slot == INDEX_NONE)
+		{
+			UE_LOG(LogEasyGasMass, Warning, TEXT("Clamp rule %s of %s refers to an unknown attribute and will be skipped"),
+				*GetNameSafe(Rule), *InAttributeSetClass->GetName());
+			continue;
+		}
+
+		const FAttributeMetaData* MetaData = FindMetaData(InMetaDataTable, ClampRule->Attribute);
+		CompiledRule.MinValue = CompileValueSource(ClampRule->MinValue, OutLayout, MetaData ? TOptional<float>(MetaData->MinValue) : TOptional<float>());
+		CompiledRule.MaxValue = CompileValueSource(ClampRule->MaxValue, OutLayout, MetaData ? TOptional<float>(MetaData->MaxValue) : TOptional<float>());
+		CompiledRule.Policy = ClampRule->Policy;
+
+		// The range can change only if it depends on attributes, and only the policy needs to know about it
+		const bool bDynamicRange = CompiledRule.MinValue.Slot != INDEX_NONE || CompiledRule.MaxValue.Slot != INDEX_NONE;
+		if (bDynamicRange && CompiledRule.Policy != FEasyGasAttributeClampPolicy::KeepAbsolute)
+		{
+			if (OutLayout.NumSlots + 2 > EasyGasMass::MaxSlots)
+			{
+				UE_LOG(LogEasyGasMass, Error, TEXT("Failed to build Mass layout: %s needs more than %d slots"),
+					*InAttributeSetClass->GetName(), EasyGasMass::MaxSlots);
+				return false;
+			}
+			CompiledRule.RangeSlot = OutLayout.NumSlots;
+			OutLayout.NumSlots += 2;
+			OutDefaults.AddZeroed(2);
+		}
+		OutLayout.ClampRules.Add(CompiledRule);
+	}
+
+	OutLayout.FragmentType = EasyGasMass::GetFragmentType(OutLayout.NumSlots);
+
+	// Clamp defaults in declaration order without applying policies
+	const FEasyGasMassAttributeValues Defaults(OutDefaults);
+	const auto SeedRange = [&Defaults](const FEasyGasMassClampRule& Rule)
+	{
+		if (Rule.RangeSlot != INDEX_NONE)
+		{
+			Defaults.SetValue(Rule.RangeSlot, Rule.MinValue.GetValue(Defaults));
+			Defaults.SetValue(Rule.RangeSlot + 1, Rule.MaxValue.GetValue(Defaults));
+		}
+	};
+	for (const FEasyGasMassClampRule& Rule : OutLayout.ClampRules)
+	{
+		SeedRange(Rule);
+		Rule.Apply(Defaults);
+	}
+
+	// A later rule may have clamped a bound of an earlier one, so the range cache is seeded
+	// from the final values, otherwise the policy would fire on the first processor pass
+	for (const FEasyGasMassClampRule& Rule : OutLayout.ClampRules)
+	{
+		SeedRange(Rule);
+	}
+	return true;
+}
+
+int32 FEasyGasMassAttributeLayout::FindSlot(const FGameplayAttribute& InAttribute) const
+{
+	return Attributes.IndexOfByKey(InAttribute);
+}
+
+void FEasyGasMassAttributeLayout::ApplyRules(const FEasyGasMassAttributeValues& Values) const
+{
+	for (const FEasyGasMassClampRule& Rule : ClampRules)
+	{
+		Rule.Apply(Values);
+	}
+}
@@ -0,0 +1,52 @@
+// Copyright 2025 Yuriy Agapov, All Rights Reserved.
+
+#include "EasyGasMassAttributeTrait.h"
+
+#include "EasyGasAttributeSet.h"
+#include "EasyGasMassAttributeFragments.h"
+
+#include <Engine/DataTable.h>
+#include <MassEntityManager.h>
+#include <MassEntityTemplateRegistry.h>
+#include <MassEntityUtils.h>
+
+namespace
+{
+	template<typename TFragment>
+	void AddAttributesFragment(FMassEntityTemplateBuildContext& BuildContext, const TArray<float>& InDefaults)
+	{
+		TFragment& Fragment = BuildContext.AddFragment_GetRef<TFragment>();
+		check(InDefaults.Num() <= UE_ARRAY_COUNT(Fragment.Values));
+		FMemory::Memcpy(Fragment.Values, InDefaults.GetData(), InDefaults.Num() * sizeof(float));
+	}
+}
+
+void UEasyGasMassAttributeTrait::BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const
+{
+	FEasyGasMassAttributeLayout Layout;
+	TArray<float> Defaults;
+	if (!FEasyGasMassAttributeLayout::Build(AttributeSetClass, MetaDataTable, Layout, Defaults))
+		return; // reported by ValidateTemplate
+
+	if (Layout.FragmentType == FEasyGasMassAttributes8Fragment::StaticStruct())
+		AddAttributesFragment<FEasyGasMassAttributes8Fragment>(BuildContext, Defaults);
+	else if (Layout.FragmentType == FEasyGasMassAttributes16Fragment::StaticStruct())
+		AddAttributesFragment<FEasyGasMassAttributes16Fragment>(BuildContext, Defaults);
+	else if (Layout.FragmentType == FEasyGasMassAttributes32Fragment::StaticStruct())
+		AddAttributesFragment<FEasyGasMassAttributes32Fragment>(BuildContext, Defaults);
+	else
+		AddAttributesFragment<FEasyGasMassAttributes64Fragment>(BuildContext, Defaults);
+
+	FMassEntityManager& EntityManager = UE::Mass::Utils::GetEntityManagerChecked(World);
+	BuildContext.AddConstSharedFragment(EntityManager.GetOrCreateConstSharedFragment(Layout));
+}
+
+bool UEasyGasMassAttributeTrait::ValidateTemplate(
+	const FMassEntityTemplateBuildContext& BuildContext,
+	const UWorld& World,
+	FAdditionalTraitRequirements& OutTraitRequirements) const
+{
+	FEasyGasMassAttributeLayout Layout;
+	TArray<float> Defaults;
+	return FEasyGasMassAttributeLayout::Build(AttributeSetClass, MetaDataTable, Layout, Defaults);
+}
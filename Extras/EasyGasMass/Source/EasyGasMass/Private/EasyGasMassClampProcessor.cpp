@@ -0,0 +1,59 @@
+// Copyright 2025 Yuriy Agapov, All Rights Reserved.
+
+#include "EasyGasMassClampProcessor.h"
+
+#include "EasyGasMassAttributeFragments.h"
+
+#include <MassExecutionContext.h>
+
+namespace
+{
+	template<typename TFragment>
+	void ConfigureQuery(FMassEntityQuery& Query)
+	{
+		Query.AddRequirement<TFragment>(EMassFragmentAccess::ReadWrite);
+		Query.AddConstSharedRequirement<FEasyGasMassAttributeLayout>();
+	}
+
+	template<typename TFragment>
+	void ExecuteQuery(FMassEntityQuery& Query, FMassExecutionContext& Context)
+	{
+		Query.ForEachEntityChunk(Context, [](FMassExecutionContext& Context)
+		{
+			const FEasyGasMassAttributeLayout& Layout = Context.GetConstSharedFragment<FEasyGasMassAttributeLayout>();
+			if (Layout.ClampRules.IsEmpty())
+				return;
+
+			for (TFragment& Fragment : Context.GetMutableFragmentView<TFragment>())
+			{
+				Layout.ApplyRules(Fragment.GetValues());
+			}
+		});
+	}
+}
+
+UEasyGasMassClampProcessor::UEasyGasMassClampProcessor()
+	: EntityQuery8(*this)
+	, EntityQuery16(*this)
+	, EntityQuery32(*this)
+	, EntityQuery64(*this)
+{
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+	ProcessingPhase = EMassProcessingPhase::PostPhysics;
+}
+
+void UEasyGasMassClampProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	ConfigureQuery<FEasyGasMassAttributes8Fragment>(EntityQuery8);
+	ConfigureQuery<FEasyGasMassAttributes16Fragment>(EntityQuery16);
+	ConfigureQuery<FEasyGasMassAttributes32Fragment>(EntityQuery32);
+	ConfigureQuery<FEasyGasMassAttributes64Fragment>(EntityQuery64);
+}
+
+void UEasyGasMassClampProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	ExecuteQuery<FEasyGasMassAttributes8Fragment>(EntityQuery8, Context);
+	ExecuteQuery<FEasyGasMassAttributes16Fragment>(EntityQuery16, Context);
+	ExecuteQuery<FEasyGasMassAttributes32Fragment>(EntityQuery32, Context);
+	ExecuteQuery<FEasyGasMassAttributes64Fragment>(EntityQuery64, Context);
+}
@@ -0,0 +1,9 @@
+// Copyright 2025 Yuriy Agapov, All Rights Reserved.
+
+#include "EasyGasMassModule.h"
+
+#include <Modules/ModuleManager.h>
+
+DEFINE_LOG_CATEGORY(LogEasyGasMass);
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, EasyGasMass)
@@ -0,0 +1,6 @@
+// Copyright 2025 Yuriy Agapov, All Rights Reserved.
+#pragma once
+
+#include <Logging/LogMacros.h>
+
+DECLARE_LOG_CATEGORY_EXTERN(LogEasyGasMass, Log, All);
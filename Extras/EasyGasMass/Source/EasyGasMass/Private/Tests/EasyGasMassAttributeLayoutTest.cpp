@@ -0,0 +1,126 @@
+// Copyright 2025 Yuriy Agapov, All Rights Reserved.
+
+#include "EasyGasMassAttributeFragments.h"
+#include "EasyGasMassTestAttributeSet.h"
+
+#include <Engine/DataTable.h>
+#include <Misc/AutomationTest.h>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyGasMassAttributeLayoutTest, "EasyGas.Mass.AttributeLayout",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEasyGasMassAttributeLayoutTest::RunTest(const FString& Parameters)
+{
+	using FTestSet = UEasyGasMassTestAttributeSet;
+
+	{
+		FEasyGasMassAttributeLayout Layout;
+		TArray<float> Defaults;
+		AddExpectedError(TEXT("AttributeSet class is not set"), EAutomationExpectedErrorFlags::Contains, 1);
+		TestFalse(TEXT("Build fails without a class"), FEasyGasMassAttributeLayout::Build(TSubclassOf<UEasyGasAttributeSet>(), nullptr, Layout, Defaults));
+	}
+	{
+		FEasyGasMassAttributeLayout Layout;
+		TArray<float> Defaults;
+		if (!TestTrue(TEXT("Build succeeds"), FEasyGasMassAttributeLayout::Build(FTestSet::StaticClass(), nullptr, Layout, Defaults)))
+			return false;
+
+		const int32 HealthSlot = Layout.FindSlot(FTestSet::GetAttribute(GET_MEMBER_NAME_CHECKED(FTestSet, Health)));
+		const int32 MaxHealthSlot = Layout.FindSlot(FTestSet::GetAttribute(GET_MEMBER_NAME_CHECKED(FTestSet, MaxHealth)));
+		const int32 StaminaSlot = Layout.FindSlot(FTestSet::GetAttribute(GET_MEMBER_NAME_CHECKED(FTestSet, Stamina)));
+		const int32 ManaSlot = Layout.FindSlot(FTestSet::GetAttribute(GET_MEMBER_NAME_CHECKED(FTestSet, Mana)));
+
+		// Slots
+		TestEqual(TEXT("All attributes are mapped"), Layout.Attributes.Num(), 4);
+		TestTrue(TEXT("Health has a slot"), Layout.Attributes.IsValidIndex(HealthSlot));
+		TestTrue(TEXT("MaxHealth has a slot"), Layout.Attributes.IsValidIndex(MaxHealthSlot));
+		TestTrue(TEXT("Stamina has a slot"), Layout.Attributes.IsValidIndex(StaminaSlot));
+		TestTrue(TEXT("Mana has a slot"), Layout.Attributes.IsValidIndex(ManaSlot));
+		TestEqual(TEXT("Unknown attribute has no slot"), Layout.FindSlot(FGameplayAttribute()), INDEX_NONE);
+		TestEqual(TEXT("Only KeepRelative rule allocates a range"), Layout.NumSlots, 6);
+		TestEqual(TEXT("Defaults cover all slots"), Defaults.Num(), Layout.NumSlots);
+		TestTrue(TEXT("Smallest fragment is used"), Layout.FragmentType == FEasyGasMassAttributes8Fragment::StaticStruct());
+
+		// Compiled rules
+		if (!TestEqual(TEXT("All clamp rules are compiled"), Layout.ClampRules.Num(), 4))
+			return false;
+
+		const FEasyGasMassClampRule& HealthRule = Layout.ClampRules[0];
+		TestEqual(TEXT("Health rule slot"), HealthRule.Slot, HealthSlot);
+		TestEqual(TEXT("Health rule constant min"), HealthRule.MinValue.Slot, INDEX_NONE);
+		TestEqual(TEXT("Health rule min without table uses cached value"), HealthRule.MinValue.Value, 0.f);
+		TestEqual(TEXT("Health rule attribute max"), HealthRule.MaxValue.Slot, MaxHealthSlot);
+		TestTrue(TEXT("Health rule policy"), HealthRule.Policy == FEasyGasAttributeClampPolicy::KeepRelative);
+		TestEqual(TEXT("Health rule range follows attributes"), HealthRule.RangeSlot, 4);
+
+		const FEasyGasMassClampRule& MaxHealthRule = Layout.ClampRules[1];
+		TestEqual(TEXT("MaxHealth rule slot"), MaxHealthRule.Slot, MaxHealthSlot);
+		TestEqual(TEXT("MaxHealth rule has no range"), MaxHealthRule.RangeSlot, INDEX_NONE);
+
+		const FEasyGasMassClampRule& StaminaRule = Layout.ClampRules[2];
+		TestEqual(TEXT("Stamina rule slot"), StaminaRule.Slot, StaminaSlot);
+		TestEqual(TEXT("Stamina rule min without table uses cached value"), StaminaRule.MinValue.Value, 0.f);
+		TestEqual(TEXT("Stamina rule max without table uses cached value"), StaminaRule.MaxValue.Value, 120.f);
+		TestEqual(TEXT("Stamina rule has no range"), StaminaRule.RangeSlot, INDEX_NONE);
+
+		const FEasyGasMassClampRule& ManaRule = Layout.ClampRules[3];
+		TestEqual(TEXT("Mana rule slot"), ManaRule.Slot, ManaSlot);
+		TestEqual(TEXT("Mana rule attribute max"), ManaRule.MaxValue.Slot, MaxHealthSlot);
+		TestEqual(TEXT("KeepAbsolute rule has no range"), ManaRule.RangeSlot, INDEX_NONE);
+
+		// Defaults
+		TestEqual(TEXT("Health default"), Defaults[HealthSlot], 50.f);
+		TestEqual(TEXT("MaxHealth default is clamped"), Defaults[MaxHealthSlot], 100.f);
+		TestEqual(TEXT("Stamina default is clamped"), Defaults[StaminaSlot], 120.f);
+		TestEqual(TEXT("Mana default is clamped"), Defaults[ManaSlot], 100.f);
+		TestEqual(TEXT("Health range min is seeded"), Defaults[HealthRule.RangeSlot], 0.f);
+		TestEqual(TEXT("Health range max is seeded from clamped MaxHealth"), Defaults[HealthRule.RangeSlot + 1], 100.f);
+
+		// The MaxHealth rule runs after the Health rule, still no policy fires on the first pass
+		TArray<float> Storage = Defaults;
+		const FEasyGasMassAttributeValues Values(Storage);
+		Layout.ApplyRules(Values);
+		TestEqual(TEXT("First pass keeps Health"), Values.GetValue(HealthSlot), 50.f);
+
+		// KeepRelative with a table-less DataTable min
+		Values.SetValue(MaxHealthSlot, 50.f);
+		Layout.ApplyRules(Values);
+		TestEqual(TEXT("Health is rescaled with DataTable min"), Values.GetValue(HealthSlot), 25.f);
+	}
+	{
+		UDataTable* MetaDataTable = NewObject<UDataTable>();
+		MetaDataTable->RowStruct = FAttributeMetaData::StaticStruct();
+
+		FAttributeMetaData HealthRow;
+		HealthRow.BaseValue = 70.f;
+		HealthRow.MinValue = 0.f;
+		MetaDataTable->AddRow(TEXT("EasyGasMassTestAttributeSet.Health"), HealthRow);
+
+		FAttributeMetaData StaminaRow;
+		StaminaRow.BaseValue = 80.f;
+		StaminaRow.MinValue = 10.f;
+		StaminaRow.MaxValue = 60.f;
+		MetaDataTable->AddRow(TEXT("EasyGasMassTestAttributeSet.Stamina"), StaminaRow);
+
+		FEasyGasMassAttributeLayout Layout;
+		TArray<float> Defaults;
+		if (!TestTrue(TEXT("Build with table succeeds"), FEasyGasMassAttributeLayout::Build(FTestSet::StaticClass(), MetaDataTable, Layout, Defaults)))
+			return false;
+
+		const int32 HealthSlot = Layout.FindSlot(FTestSet::GetAttribute(GET_MEMBER_NAME_CHECKED(FTestSet, Health)));
+		const int32 StaminaSlot = Layout.FindSlot(FTestSet::GetAttribute(GET_MEMBER_NAME_CHECKED(FTestSet, Stamina)));
+		TestEqual(TEXT("Health base value from table"), Defaults[HealthSlot], 70.f);
+		TestEqual(TEXT("Stamina base value from table is clamped"), Defaults[StaminaSlot], 60.f);
+
+		if (TestEqual(TEXT("All clamp rules are compiled"), Layout.ClampRules.Num(), 4))
+		{
+			TestEqual(TEXT("Stamina rule min from table"), Layout.ClampRules[2].MinValue.Value, 10.f);
+			TestEqual(TEXT("Stamina rule max from table"), Layout.ClampRules[2].MaxValue.Value, 60.f);
+		}
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
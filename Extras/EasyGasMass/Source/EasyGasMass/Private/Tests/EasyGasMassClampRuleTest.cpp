@@ -0,0 +1,123 @@
+// Copyright 2025 Yuriy Agapov, All Rights Reserved.
+
+#include "EasyGasMassAttributeFragments.h"
+
+#include <Misc/AutomationTest.h>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	enum ESlot : int32
+	{
+		Health,
+		MaxHealth,
+		HealthRange,
+		NumSlots = HealthRange + 2
+	};
+
+	/// Health clamped to [0, MaxHealth]
+	FEasyGasMassAttributeLayout MakeHealthLayout(const FEasyGasAttributeClampPolicy Policy)
+	{
+		FEasyGasMassClampRule Rule;
+		Rule.Slot = Health;
+		Rule.MinValue.Value = 0.f;
+		Rule.MaxValue.Slot = MaxHealth;
+		Rule.Policy = Policy;
+		// Same as FEasyGasMassAttributeLayout::Build, the range is tracked only when the policy needs it
+		Rule.RangeSlot = Policy != FEasyGasAttributeClampPolicy::KeepAbsolute ? HealthRange : INDEX_NONE;
+
+		FEasyGasMassAttributeLayout Layout;
+		Layout.ClampRules.Add(Rule);
+		Layout.NumSlots = NumSlots;
+		return Layout;
+	}
+
+	TArray<float> MakeHealthValues(const float InHealth, const float InMaxHealth)
+	{
+		TArray<float> Values;
+		Values.SetNumZeroed(NumSlots);
+		Values[Health] = InHealth;
+		Values[MaxHealth] = InMaxHealth;
+		Values[HealthRange] = 0.f;
+		Values[HealthRange + 1] = InMaxHealth;
+		return Values;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyGasMassClampRuleTest, "EasyGas.Mass.ClampRule",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEasyGasMassClampRuleTest::RunTest(const FString& Parameters)
+{
+	{
+		const FEasyGasMassAttributeLayout Layout = MakeHealthLayout(FEasyGasAttributeClampPolicy::KeepAbsolute);
+		TArray<float> Storage = MakeHealthValues(50.f, 100.f);
+		const FEasyGasMassAttributeValues Attributes(Storage);
+
+		Attributes.SetValue(Health, 150.f);
+		Layout.ApplyRules(Attributes);
+		TestEqual(TEXT("KeepAbsolute: clamped to max"), Attributes.GetValue(Health), 100.f);
+
+		Attributes.SetValue(Health, -10.f);
+		Layout.ApplyRules(Attributes);
+		TestEqual(TEXT("KeepAbsolute: clamped to min"), Attributes.GetValue(Health), 0.f);
+
+		Attributes.SetValue(Health, 40.f);
+		Attributes.SetValue(MaxHealth, 200.f);
+		Layout.ApplyRules(Attributes);
+		TestEqual(TEXT("KeepAbsolute: range change keeps value"), Attributes.GetValue(Health), 40.f);
+
+		Attributes.SetValue(MaxHealth, 30.f);
+		Layout.ApplyRules(Attributes);
+		TestEqual(TEXT("KeepAbsolute: value is clamped to the new range"), Attributes.GetValue(Health), 30.f);
+	}
+	{
+		const FEasyGasMassAttributeLayout Layout = MakeHealthLayout(FEasyGasAttributeClampPolicy::KeepRelative);
+		TArray<float> Storage = MakeHealthValues(50.f, 100.f);
+		const FEasyGasMassAttributeValues Attributes(Storage);
+
+		Layout.ApplyRules(Attributes);
+		TestEqual(TEXT("KeepRelative: unchanged range keeps value"), Attributes.GetValue(Health), 50.f);
+
+		Attributes.SetValue(MaxHealth, 200.f);
+		Layout.ApplyRules(Attributes);
+		TestEqual(TEXT("KeepRelative: value is rescaled"), Attributes.GetValue(Health), 100.f);
+
+		Attributes.SetValue(MaxHealth, 20.f);
+		Layout.ApplyRules(Attributes);
+		TestEqual(TEXT("KeepRelative: value is rescaled down"), Attributes.GetValue(Health), 10.f);
+	}
+	{
+		const FEasyGasMassAttributeLayout Layout = MakeHealthLayout(FEasyGasAttributeClampPolicy::KeepRelative);
+		TArray<float> Storage = MakeHealthValues(0.f, 0.f);
+		const FEasyGasMassAttributeValues Attributes(Storage);
+
+		Attributes.SetValue(MaxHealth, 100.f);
+		Layout.ApplyRules(Attributes);
+		TestEqual(TEXT("KeepRelative: empty old range is treated as full"), Attributes.GetValue(Health), 100.f);
+		TestEqual(TEXT("KeepRelative: range cache min is updated"), Attributes.GetValue(HealthRange), 0.f);
+		TestEqual(TEXT("KeepRelative: range cache max is updated"), Attributes.GetValue(HealthRange + 1), 100.f);
+	}
+	{
+		const FEasyGasMassAttributeLayout Layout = MakeHealthLayout(FEasyGasAttributeClampPolicy::UseMin);
+		TArray<float> Storage = MakeHealthValues(50.f, 100.f);
+		const FEasyGasMassAttributeValues Attributes(Storage);
+
+		Attributes.SetValue(MaxHealth, 200.f);
+		Layout.ApplyRules(Attributes);
+		TestEqual(TEXT("UseMin: value is reset to min"), Attributes.GetValue(Health), 0.f);
+	}
+	{
+		const FEasyGasMassAttributeLayout Layout = MakeHealthLayout(FEasyGasAttributeClampPolicy::UseMax);
+		TArray<float> Storage = MakeHealthValues(50.f, 100.f);
+		const FEasyGasMassAttributeValues Attributes(Storage);
+
+		Attributes.SetValue(MaxHealth, 200.f);
+		Layout.ApplyRules(Attributes);
+		TestEqual(TEXT("UseMax: value is reset to max"), Attributes.GetValue(Health), 200.f);
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,44 @@
+// Copyright 2025 Yuriy Agapov, All Rights Reserved.
+
+#include "EasyGasMassTestAttributeSet.h"
+
+#include "EasyGasAttributeClampRule.h"
+
+UEasyGasMassTestAttributeSet::UEasyGasMassTestAttributeSet()
+	: Health(50.f)
+	, MaxHealth(200.f)
+	, Stamina(150.f)
+	, Mana(200.f)
+{
+	UEasyGasAttributeClampRule* HealthClamp = CreateDefaultSubobject<UEasyGasAttributeClampRule>(TEXT("HealthClamp"));
+	HealthClamp->Attribute = GetAttribute(GET_MEMBER_NAME_CHECKED(ThisClass, Health));
+	// MinValue is a DataTable source with cached value 0
+	HealthClamp->MaxValue = FEasyGasValueSource(GetAttribute(GET_MEMBER_NAME_CHECKED(ThisClass, MaxHealth)));
+	HealthClamp->Policy = FEasyGasAttributeClampPolicy::KeepRelative;
+
+	// Declared after the Health rule that depends on it
+	UEasyGasAttributeClampRule* MaxHealthClamp = CreateDefaultSubobject<UEasyGasAttributeClampRule>(TEXT("MaxHealthClamp"));
+	MaxHealthClamp->Attribute = GetAttribute(GET_MEMBER_NAME_CHECKED(ThisClass, MaxHealth));
+	MaxHealthClamp->MinValue = FEasyGasValueSource(0.f);
+	MaxHealthClamp->MaxValue = FEasyGasValueSource(100.f);
+
+	// Default value sources use the DataTable
+	UEasyGasAttributeClampRule* StaminaClamp = CreateDefaultSubobject<UEasyGasAttributeClampRule>(TEXT("StaminaClamp"));
+	StaminaClamp->Attribute = GetAttribute(GET_MEMBER_NAME_CHECKED(ThisClass, Stamina));
+	StaminaClamp->MaxValue.Value = 120.f;
+
+	UEasyGasAttributeClampRule* ManaClamp = CreateDefaultSubobject<UEasyGasAttributeClampRule>(TEXT("ManaClamp"));
+	ManaClamp->Attribute = GetAttribute(GET_MEMBER_NAME_CHECKED(ThisClass, Mana));
+	ManaClamp->MinValue = FEasyGasValueSource(0.f);
+	ManaClamp->MaxValue = FEasyGasValueSource(GetAttribute(GET_MEMBER_NAME_CHECKED(ThisClass, MaxHealth)));
+
+	AddRule(HealthClamp);
+	AddRule(MaxHealthClamp);
+	AddRule(StaminaClamp);
+	AddRule(ManaClamp);
+}
+
+FGameplayAttribute UEasyGasMassTestAttributeSet::GetAttribute(const FName& InPropertyName)
+{
+	return FGameplayAttribute(FindFProperty<FProperty>(StaticClass(), InPropertyName));
+}
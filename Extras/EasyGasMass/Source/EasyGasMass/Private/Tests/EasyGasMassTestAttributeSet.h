@@ -0,0 +1,38 @@
+// Copyright 2025 Yuriy Agapov, All Rights Reserved.
+#pragma once
+
+#include "EasyGasAttributeSet.h"
+
+#include "EasyGasMassTestAttributeSet.generated.h"
+
+/**
+ * Native AttributeSet used by EasyGasMass tests.
+ *
+ * Rules:
+ * - Health is clamped to [DataTable (0 without a row), MaxHealth] with KeepRelative policy;
+ * - MaxHealth (200 by default) is clamped to [0, 100] with KeepAbsolute policy, after the Health rule;
+ * - Stamina is clamped to the DataTable range (0..120 without a row) with KeepAbsolute policy;
+ * - Mana is clamped to [0, MaxHealth] with KeepAbsolute policy.
+ */
+UCLASS(HideDropdown)
+class UEasyGasMassTestAttributeSet : public UEasyGasAttributeSet
+{
+	GENERATED_BODY()
+public:
+	UEasyGasMassTestAttributeSet();
+
+	UPROPERTY()
+	FGameplayAttributeData Health;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxHealth;
+
+	UPROPERTY()
+	FGameplayAttributeData Stamina;
+
+	UPROPERTY()
+	FGameplayAttributeData Mana;
+
+	/// Returns the attribute for the given property name.
+	static FGameplayAttribute GetAttribute(const FName& InPropertyName);
+};
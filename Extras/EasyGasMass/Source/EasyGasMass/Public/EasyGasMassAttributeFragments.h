@@ -0,0 +1,214 @@
+﻿// Copyright 2025 Yuriy Agapov, All Rights Reserved.
+#pragma once
+
+#include "EasyGasAttributeClampRule.h"
+
+#include <AttributeSet.h>
+#include <MassEntityTypes.h>
+
+#include "EasyGasMassAttributeFragments.generated.h"
+
+class UDataTable;
+class UEasyGasAttributeSet;
+
+namespace EasyGasMass
+{
+	/**
+	 * Maximum number of float slots per entity (attributes plus the range cache of clamp rules).
+	 *
+	 * Slots are stored inline, the smallest of the 8/16/32/64 slot fragments that fits the layout is used.
+	 * The largest one costs 256 bytes (four cache lines) per entity.
+	 */
+	inline constexpr int32 MaxSlots = 64;
+
+	/// Returns the smallest attributes fragment type that fits the given number of slots, nullptr if none.
+	EASYGASMASS_API const UScriptStruct* GetFragmentType(const int32 InNumSlots);
+}
+
+/**
+ * View over the packed attribute values of a Mass entity.
+ *
+ * Each attribute of the source AttributeSet class is mapped to a slot, see FEasyGasMassAttributeLayout.
+ * There is no aggregator in Mass, so a single value per attribute is stored.
+ */
+struct FEasyGasMassAttributeValues
+{
+	explicit FEasyGasMassAttributeValues(const TArrayView<float> InValues) : Values(InValues) {}
+
+	/// Returns the value stored in the given slot.
+	float GetValue(const int32 Slot) const
+	{
+		check(Values.IsValidIndex(Slot));
+		return Values[Slot];
+	}
+
+	/// Sets the value stored in the given slot, rules are applied on the next processor pass.
+	void SetValue(const int32 Slot, const float Value) const
+	{
+		check(Values.IsValidIndex(Slot));
+		Values[Slot] = Value;
+	}
+
+private:
+	TArrayView<float> Values;
+};
+
+/// Attribute values of layouts with up to 8 slots.
+USTRUCT()
+struct EASYGASMASS_API FEasyGasMassAttributes8Fragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	FEasyGasMassAttributeValues GetValues() { return FEasyGasMassAttributeValues(MakeArrayView(Values)); }
+
+	UPROPERTY()
+	float Values[8] = {};
+};
+
+/// Attribute values of layouts with up to 16 slots.
+USTRUCT()
+struct EASYGASMASS_API FEasyGasMassAttributes16Fragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	FEasyGasMassAttributeValues GetValues() { return FEasyGasMassAttributeValues(MakeArrayView(Values)); }
+
+	UPROPERTY()
+	float Values[16] = {};
+};
+
+/// Attribute values of layouts with up to 32 slots.
+USTRUCT()
+struct EASYGASMASS_API FEasyGasMassAttributes32Fragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	FEasyGasMassAttributeValues GetValues() { return FEasyGasMassAttributeValues(MakeArrayView(Values)); }
+
+	UPROPERTY()
+	float Values[32] = {};
+};
+
+/// Attribute values of layouts with up to 64 slots.
+USTRUCT()
+struct EASYGASMASS_API FEasyGasMassAttributes64Fragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	FEasyGasMassAttributeValues GetValues() { return FEasyGasMassAttributeValues(MakeArrayView(Values)); }
+
+	UPROPERTY()
+	float Values[EasyGasMass::MaxSlots] = {};
+};
+
+/**
+ * Value source compiled from FEasyGasValueSource.
+ *
+ * Either reads a slot of the entity values or returns a constant
+ * (DataTable sources are resolved to constants when the layout is built).
+ */
+USTRUCT()
+struct EASYGASMASS_API FEasyGasMassValueSource
+{
+	GENERATED_BODY()
+
+	/// Slot of the source attribute, INDEX_NONE for constants.
+	UPROPERTY()
+	int32 Slot = INDEX_NONE;
+
+	/// Constant value (used when Slot == INDEX_NONE).
+	UPROPERTY()
+	float Value = 0.f;
+
+	/// Returns the resolved value for the given entity.
+	float GetValue(const FEasyGasMassAttributeValues& Values) const
+	{
+		return Slot != INDEX_NONE ? Values.GetValue(Slot) : Value;
+	}
+};
+
+/**
+ * Clamp rule compiled from UEasyGasAttributeClampRule.
+ */
+USTRUCT()
+struct EASYGASMASS_API FEasyGasMassClampRule
+{
+	GENERATED_BODY()
+
+	/// Slot of the clamped attribute.
+	UPROPERTY()
+	int32 Slot = INDEX_NONE;
+
+	/// Minimum value for clamping.
+	UPROPERTY()
+	FEasyGasMassValueSource MinValue;
+
+	/// Maximum value for clamping.
+	UPROPERTY()
+	FEasyGasMassValueSource MaxValue;
+
+	/// The policy applied when the range changes.
+	UPROPERTY()
+	FEasyGasAttributeClampPolicy Policy = FEasyGasAttributeClampPolicy::KeepAbsolute;
+
+	/// First of two slots holding the last applied min/max, INDEX_NONE if the range can't change.
+	UPROPERTY()
+	int32 RangeSlot = INDEX_NONE;
+
+	/// Applies the policy if the range has changed and clamps the attribute value.
+	void Apply(const FEasyGasMassAttributeValues& Values) const;
+};
+
+/**
+ * Attribute layout shared by all entities created from the same AttributeSet class.
+ *
+ * Built from a Blueprint (or native) UEasyGasAttributeSet class: every attribute gets a slot
+ * in the attributes fragment, and supported rules are compiled into plain data.
+ * Currently only Clamp rules are compiled, other rules are skipped.
+ */
+USTRUCT()
+struct EASYGASMASS_API FEasyGasMassAttributeLayout : public FMassConstSharedFragment
+{
+	GENERATED_BODY()
+
+	/**
+	 * Builds the layout and default values for the given AttributeSet class.
+	 *
+	 * @param InAttributeSetClass  The AttributeSet class to convert.
+	 * @param InMetaDataTable      Optional attribute metadata (FAttributeMetaData rows named <AttributeSet>.<Attribute>).
+	 * @param OutLayout            The resulting layout.
+	 * @param OutDefaults          The resulting default values, one per slot.
+	 * @return True on success, false if the class is invalid or needs more than EasyGasMass::MaxSlots slots.
+	 */
+	static bool Build(
+		const TSubclassOf<UEasyGasAttributeSet>& InAttributeSetClass,
+		const UDataTable* InMetaDataTable,
+		FEasyGasMassAttributeLayout& OutLayout,
+		TArray<float>& OutDefaults);
+
+	/// Returns the slot of the attribute or INDEX_NONE if the attribute isn't part of the layout.
+	int32 FindSlot(const FGameplayAttribute& InAttribute) const;
+
+	/// Applies all compiled rules to the entity values.
+	void ApplyRules(const FEasyGasMassAttributeValues& Values) const;
+
+	/// AttributeSet class the layout was built from.
+	UPROPERTY()
+	TSubclassOf<UEasyGasAttributeSet> AttributeSetClass;
+
+	/// Attributes in slot order.
+	UPROPERTY()
+	TArray<FGameplayAttribute> Attributes;
+
+	/// Compiled clamp rules in the order they are declared in the AttributeSet.
+	UPROPERTY()
+	TArray<FEasyGasMassClampRule> ClampRules;
+
+	/// Number of used slots (attributes plus range cache).
+	UPROPERTY()
+	int32 NumSlots = 0;
+
+	/// Attributes fragment type used by entities with this layout (see EasyGasMass::GetFragmentType).
+	UPROPERTY()
+	TObjectPtr<const UScriptStruct> FragmentType;
+};
@@ -0,0 +1,39 @@
+﻿// Copyright 2025 Yuriy Agapov, All Rights Reserved.
+#pragma once
+
+#include <MassEntityTraitBase.h>
+#include <Templates/SubclassOf.h>
+
+#include "EasyGasMassAttributeTrait.generated.h"
+
+class UDataTable;
+class UEasyGasAttributeSet;
+
+/**
+ * Mass trait that adds EasyGas attributes to an entity.
+ *
+ * The attributes of `AttributeSetClass` are packed into the smallest fitting attributes fragment,
+ * and its Clamp rules are executed by UEasyGasMassClampProcessor.
+ * This allows lightweight agents to share the attribute schema of an EasyGasAttributeSet
+ * without creating an AttributeSet or AbilitySystemComponent per agent.
+ * The template is reported as invalid if the layout can't be built.
+ */
+UCLASS(meta=(DisplayName="EasyGas Attributes"))
+class EASYGASMASS_API UEasyGasMassAttributeTrait : public UMassEntityTraitBase
+{
+	GENERATED_BODY()
+public:
+	/// AttributeSet class that defines the attributes and rules.
+	UPROPERTY(EditAnywhere, Category="EasyGas|Mass")
+	TSubclassOf<UEasyGasAttributeSet> AttributeSetClass;
+
+	/// Optional metadata table (FAttributeMetaData) used for base values and DataTable value sources.
+	UPROPERTY(EditAnywhere, Category="EasyGas|Mass", meta=(RequiredAssetDataTags="RowStructure=/Script/GameplayAbilities.AttributeMetaData"))
+	TObjectPtr<const UDataTable> MetaDataTable;
+
+protected:
+	// begin UMassEntityTraitBase
+	virtual void BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const override;
+	virtual bool ValidateTemplate(const FMassEntityTemplateBuildContext& BuildContext, const UWorld& World, FAdditionalTraitRequirements& OutTraitRequirements) const override;
+	// end UMassEntityTraitBase
+};
@@ -0,0 +1,33 @@
+﻿// Copyright 2025 Yuriy Agapov, All Rights Reserved.
+#pragma once
+
+#include <MassEntityQuery.h>
+#include <MassProcessor.h>
+
+#include "EasyGasMassClampProcessor.generated.h"
+
+/**
+ * Applies compiled EasyGas rules to entities with an attributes fragment.
+ *
+ * Runs after physics, so values written by gameplay processors are clamped in the same frame.
+ */
+UCLASS()
+class EASYGASMASS_API UEasyGasMassClampProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+public:
+	UEasyGasMassClampProcessor();
+
+protected:
+	// begin UMassProcessor
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+	// end UMassProcessor
+
+private:
+	/// One query per attributes fragment size.
+	FMassEntityQuery EntityQuery8;
+	FMassEntityQuery EntityQuery16;
+	FMassEntityQuery EntityQuery32;
+	FMassEntityQuery EntityQuery64;
+};